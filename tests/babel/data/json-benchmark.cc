@@ -0,0 +1,30 @@
+#include <nexus/test.hh>
+
+#include <iostream>
+
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include <babel-serializer/data/json.hh>
+
+#include "../../measure_ms.hh"
+
+#define DO_BENCHMARK 0
+
+TEST("json float array benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+    auto values = cc::vector<float>::defaulted(10'000'000);
+    for (auto& v : values)
+        v = uniform(rng, -1000.f, 1000.f);
+
+    size_t json_size = 0;
+    measure_ms("babel::json::to_string(10M floats)", [&] { json_size = babel::json::to_string(values).size(); });
+    std::cout << "  " << json_size / 1024 / 1024 << " MB of json" << std::endl;
+}
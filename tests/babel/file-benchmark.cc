@@ -0,0 +1,38 @@
+#include <nexus/test.hh>
+
+#include <cstdio>
+#include <string>
+
+#include <clean-core/string.hh>
+#include <clean-core/string_stream.hh>
+#include <clean-core/string_view.hh>
+
+#include <babel-serializer/file.hh>
+
+#include "../measure_ms.hh"
+
+#define DO_BENCHMARK 0
+
+TEST("file write benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    auto tmp_file = "_tmp_babel_file_benchmark";
+
+    // ~256 MB of generated text
+    cc::string_stream ss;
+    while (ss.size() < (256 << 20))
+        ss << cc::string_view("{\"id\": 12345, \"name\": \"some entity\", \"tags\": [\"a\", \"b\", \"c\"]},\n");
+
+    auto const mb = std::to_string(ss.size() / 1024 / 1024) + " MB";
+
+    // currently the stream has to be concatenated into one string before it can be written
+    cc::string s;
+    measure_ms("cc::string_stream::to_string (" + mb + ")", [&] { s = ss.to_string(); });
+    measure_ms("babel::file::write (" + mb + ")", [&] { babel::file::write(tmp_file, s); });
+
+    std::remove(tmp_file);
+}
@@ -0,0 +1,46 @@
+#include <nexus/test.hh>
+
+#include <string>
+
+#include <clean-core/span.hh>
+#include <clean-core/string.hh>
+#include <clean-core/string_view.hh>
+#include <clean-core/to_string.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include <babel-serializer/geometry/obj.hh>
+
+#include "../../measure_ms.hh"
+
+#define DO_BENCHMARK 0
+
+TEST("obj read benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    constexpr int vertex_count = 1'000'000;
+
+    // mostly number parsing: one vertex and one normal line per vertex, triangle fan faces
+    tg::rng rng;
+    cc::string file;
+    for (auto i = 0; i < vertex_count; ++i)
+    {
+        file += "v " + cc::to_string(uniform(rng, -10.f, 10.f)) + " " + cc::to_string(uniform(rng, -10.f, 10.f)) + " "
+                + cc::to_string(uniform(rng, -10.f, 10.f)) + "\n";
+        file += "vn " + cc::to_string(uniform(rng, -1.f, 1.f)) + " " + cc::to_string(uniform(rng, -1.f, 1.f)) + " "
+                + cc::to_string(uniform(rng, -1.f, 1.f)) + "\n";
+    }
+    for (auto i = 2; i < vertex_count; ++i)
+        file += "f 1 " + cc::to_string(i) + " " + cc::to_string(i + 1) + "\n";
+
+    size_t read_vertices = 0;
+    measure_ms("babel::obj::read (" + std::to_string(file.size() / 1024 / 1024) + " MB)", [&] {
+        auto const geometry = babel::obj::read(cc::as_byte_span(cc::string_view(file)));
+        read_vertices = geometry.vertices.size();
+    });
+    CHECK(read_vertices == vertex_count);
+}
@@ -1,7 +1,9 @@
 #include <nexus/test.hh>
 
+#include <atomic>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <ctracer/benchmark.hh>
@@ -9,6 +11,8 @@
 #include <clean-core/allocate.hh>
 #include <clean-core/array.hh>
 
+#include "benchmark_util.hh"
+
 #define DO_BENCHMARK 0
 
 namespace
@@ -44,27 +48,62 @@ private:
     std::byte* _curr;
 };
 
-template <class F, class C>
-void measure(std::string name, size_t samples, F&& f, C&& cleanup)
+// free list for a single block size, owned by one thread (no cross-thread free)
+// serves as the upper bound for a thread-caching pool
+struct freelist_alloc
 {
-    constexpr auto cnt = 3;
-    uint64_t cycles[cnt];
-    for (auto i = 0; i < cnt; ++i)
+    explicit freelist_alloc(size_t block_size) : _block_size(block_size < sizeof(void*) ? sizeof(void*) : block_size) {}
+    ~freelist_alloc()
     {
-        auto c = ct::current_cycles();
-        f();
-        cycles[i] = (ct::current_cycles() - c) / samples;
-        cleanup();
+        while (_head)
+        {
+            auto next = *static_cast<void**>(_head);
+            ::operator delete(_head);
+            _head = next;
+        }
     }
-    // std::cout << name << ": " << cycles[0] << ", " << cycles[1] << ", " << cycles[2] << " cycles / sample" << std::endl;
-    std::cout << name << ": " << cycles[2] << " cycles / sample" << std::endl;
-}
-template <class F>
-void measure(std::string name, size_t samples, F&& f)
+
+    void* alloc()
+    {
+        if (!_head)
+            return ::operator new(_block_size);
+
+        auto p = _head;
+        _head = *static_cast<void**>(p);
+        return p;
+    }
+    void free(void* p)
+    {
+        *static_cast<void**>(p) = _head;
+        _head = p;
+    }
+
+private:
+    size_t _block_size;
+    void* _head = nullptr;
+};
+
+// allocates a batch on each thread, then every thread frees the batch of its neighbor
+template <class AllocF, class FreeF>
+void measure_cross_thread_free(std::string const& name, int num_threads, size_t batch_size, AllocF&& alloc, FreeF&& free)
 {
-    return measure(name, samples, f, [] {});
-}
+    std::vector<std::vector<void*>> batches(num_threads);
+    std::atomic<int> arrived = 0;
+
+    measure_threads(name, num_threads, batch_size, [&](int t) {
+        auto& batch = batches[t];
+        batch.resize(batch_size);
+        for (auto& p : batch)
+            p = alloc();
 
+        ++arrived;
+        while (arrived < num_threads)
+            std::this_thread::yield();
+
+        for (auto p : batches[(t + 1) % num_threads])
+            free(p);
+    });
+}
 }
 TEST("cc::alloc benchmark")
 {
@@ -178,3 +217,94 @@ TEST("cc::alloc benchmark")
         }
     });
 }
+
+TEST("cc::alloc multi-threaded benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    constexpr size_t ops = 1'000'000;
+    constexpr size_t batch_size = 10'000;
+
+    auto const max_threads = int(std::thread::hardware_concurrency());
+    for (auto num_threads : {1, 2, 4, 8, 16})
+    {
+        if (num_threads > max_threads)
+            break;
+
+        std::cout << "== " << num_threads << " threads ==" << std::endl;
+
+        // hot: free directly after alloc
+        measure_threads("(hot) new/delete int", num_threads, ops, [&](int) {
+            for (size_t i = 0; i < ops; ++i)
+            {
+                auto p = new int();
+                ct::sink << p;
+                delete p;
+            }
+        });
+        measure_threads("(hot) cc::alloc int", num_threads, ops, [&](int) {
+            for (size_t i = 0; i < ops; ++i)
+            {
+                auto p = cc::alloc<int>();
+                ct::sink << p;
+                cc::free(p);
+            }
+        });
+        measure_threads("(hot) thread-local free list int", num_threads, ops, [&](int) {
+            freelist_alloc fl(sizeof(int));
+            for (size_t i = 0; i < ops; ++i)
+            {
+                auto p = fl.alloc();
+                ct::sink << p;
+                fl.free(p);
+            }
+        });
+
+        // cold: many live allocations per thread
+        measure_threads("(cold) new/delete array<int, 100>", num_threads, ops, [&](int) {
+            std::vector<cc::array<int, 100>*> ptrs(batch_size);
+            for (size_t r = 0; r < ops / batch_size; ++r)
+            {
+                for (auto& p : ptrs)
+                    p = new cc::array<int, 100>();
+                for (auto p : ptrs)
+                    delete p;
+            }
+        });
+        measure_threads("(cold) cc::alloc array<int, 100>", num_threads, ops, [&](int) {
+            std::vector<cc::array<int, 100>*> ptrs(batch_size);
+            for (size_t r = 0; r < ops / batch_size; ++r)
+            {
+                for (auto& p : ptrs)
+                    p = cc::alloc<cc::array<int, 100>>();
+                for (auto p : ptrs)
+                    cc::free(p);
+            }
+        });
+        measure_threads("(cold) thread-local free list array<int, 100>", num_threads, ops, [&](int) {
+            freelist_alloc fl(sizeof(cc::array<int, 100>));
+            std::vector<void*> ptrs(batch_size);
+            for (size_t r = 0; r < ops / batch_size; ++r)
+            {
+                for (auto& p : ptrs)
+                    p = fl.alloc();
+                for (auto p : ptrs)
+                    fl.free(p);
+            }
+        });
+
+        // cross-thread free: memory allocated on one thread is released on another
+        if (num_threads > 1)
+        {
+            measure_cross_thread_free(
+                "(cross-thread) new/delete int", num_threads, batch_size, [] { return static_cast<void*>(new int()); },
+                [](void* p) { delete static_cast<int*>(p); });
+            measure_cross_thread_free(
+                "(cross-thread) cc::alloc int", num_threads, batch_size, [] { return static_cast<void*>(cc::alloc<int>()); },
+                [](void* p) { cc::free(static_cast<int*>(p)); });
+        }
+    }
+}
@@ -0,0 +1,216 @@
+#include <nexus/test.hh>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <clean-core/allocator.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// the bookkeeping a tracking allocator decorator would do per call
+// measured around cc::system_allocator to see which variant stays within a few percent of the raw calls
+
+struct shared_stats
+{
+    std::atomic<int64_t> count = 0;
+    std::atomic<int64_t> bytes = 0;
+    std::atomic<int64_t> live_bytes = 0;
+    std::atomic<int64_t> peak_live_bytes = 0;
+
+    void on_alloc(size_t size)
+    {
+        ++count;
+        bytes += int64_t(size);
+        auto const live = live_bytes += int64_t(size);
+        auto peak = peak_live_bytes.load(std::memory_order_relaxed);
+        while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+        {
+        }
+    }
+    void on_free(size_t size) { live_bytes -= int64_t(size); }
+};
+
+// per-thread counters, merged when a report is requested
+// only the owning thread writes, so relaxed load + store is enough and there is no contended read-modify-write
+struct local_stats
+{
+    std::atomic<int64_t> count = 0;
+    std::atomic<int64_t> bytes = 0;
+    std::atomic<int64_t> live_bytes = 0;
+    std::atomic<int64_t> peak_live_bytes = 0;
+
+    static int64_t add(std::atomic<int64_t>& v, int64_t d)
+    {
+        auto const r = v.load(std::memory_order_relaxed) + d;
+        v.store(r, std::memory_order_relaxed);
+        return r;
+    }
+
+    void on_alloc(size_t size)
+    {
+        add(count, 1);
+        add(bytes, int64_t(size));
+        auto const live = add(live_bytes, int64_t(size));
+        if (live > peak_live_bytes.load(std::memory_order_relaxed))
+            peak_live_bytes.store(live, std::memory_order_relaxed);
+    }
+    void on_free(size_t size) { add(live_bytes, -int64_t(size)); }
+};
+
+struct merged_stats
+{
+    int64_t count = 0;
+    int64_t bytes = 0;
+    int64_t live_bytes = 0;
+    int64_t peak_live_bytes = 0; // sum of per-thread peaks, an upper bound of the true peak
+};
+
+// owns the stats of every thread that ever allocated, so they survive the thread and can be merged at report time
+struct stats_registry
+{
+    std::mutex mutex;
+    std::vector<std::unique_ptr<local_stats>> stats;
+
+    local_stats& register_thread()
+    {
+        auto lock = std::lock_guard(mutex);
+        return *stats.emplace_back(std::make_unique<local_stats>());
+    }
+
+    merged_stats merge()
+    {
+        auto lock = std::lock_guard(mutex);
+        merged_stats r;
+        for (auto const& s : stats)
+        {
+            r.count += s->count.load(std::memory_order_relaxed);
+            r.bytes += s->bytes.load(std::memory_order_relaxed);
+            r.live_bytes += s->live_bytes.load(std::memory_order_relaxed);
+            r.peak_live_bytes += s->peak_live_bytes.load(std::memory_order_relaxed);
+        }
+        return r;
+    }
+};
+
+stats_registry& registry()
+{
+    static stats_registry r;
+    return r;
+}
+
+local_stats& thread_stats()
+{
+    thread_local local_stats& stats = registry().register_thread();
+    return stats;
+}
+
+// per call-site stats behind a single lock, the naive variant
+struct callsite_stats
+{
+    struct site
+    {
+        int64_t bytes = 0;
+        int64_t live_bytes = 0;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<char const*, site> sites;
+
+    void on_alloc(char const* tag, size_t size)
+    {
+        auto lock = std::lock_guard(mutex);
+        auto& s = sites[tag];
+        s.bytes += int64_t(size);
+        s.live_bytes += int64_t(size);
+    }
+    void on_free(char const* tag, size_t size)
+    {
+        auto lock = std::lock_guard(mutex);
+        sites[tag].live_bytes -= int64_t(size);
+    }
+};
+
+// distinct tags, as if the allocations came from different places in the code
+constexpr char const* site_tags[] = {
+    "mesh/vertices", "mesh/indices", "texture/mips",  "shader/bytecode", "scene/nodes", "scene/instances", "audio/buffers", "ui/glyphs",
+    "json/values",   "obj/faces",    "task/closures", "string/concat",   "log/lines",   "physics/bodies",  "net/packets",   "misc",
+};
+constexpr size_t site_count = sizeof(site_tags) / sizeof(site_tags[0]);
+}
+
+TEST("cc::allocator tracking overhead benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    constexpr size_t ops = 1'000'000;
+    constexpr size_t size = 64;
+
+    shared_stats shared;
+    callsite_stats callsites;
+
+    auto const max_threads = int(std::thread::hardware_concurrency());
+    for (auto num_threads : {1, 2, 4, 8, 16})
+    {
+        if (num_threads > max_threads)
+            break;
+
+        std::cout << "== " << num_threads << " threads ==" << std::endl;
+
+        measure_threads("untracked", num_threads, ops, [&](int) {
+            for (size_t i = 0; i < ops; ++i)
+            {
+                auto p = cc::system_allocator->alloc(size);
+                ct::sink << p;
+                cc::system_allocator->free(p);
+            }
+        });
+        measure_threads("shared atomic counters", num_threads, ops, [&](int) {
+            for (size_t i = 0; i < ops; ++i)
+            {
+                auto p = cc::system_allocator->alloc(size);
+                shared.on_alloc(size);
+                ct::sink << p;
+                cc::system_allocator->free(p);
+                shared.on_free(size);
+            }
+        });
+        measure_threads("thread-local counters", num_threads, ops, [&](int) {
+            auto& stats = thread_stats();
+            for (size_t i = 0; i < ops; ++i)
+            {
+                auto p = cc::system_allocator->alloc(size);
+                stats.on_alloc(size);
+                ct::sink << p;
+                cc::system_allocator->free(p);
+                stats.on_free(size);
+            }
+        });
+        // the report side: merge every registered thread's counters
+        measure("thread-local counters merge (" + std::to_string(registry().stats.size()) + " threads registered)", 1, [&] {
+            auto const m = registry().merge();
+            ct::sink << m.count + m.bytes + m.live_bytes + m.peak_live_bytes;
+        });
+        measure_threads("locked call-site map", num_threads, ops, [&](int) {
+            for (size_t i = 0; i < ops; ++i)
+            {
+                auto p = cc::system_allocator->alloc(size);
+                auto const tag = site_tags[i % site_count];
+                callsites.on_alloc(tag, size);
+                ct::sink << p;
+                cc::system_allocator->free(p);
+                callsites.on_free(tag, size);
+            }
+        });
+    }
+}
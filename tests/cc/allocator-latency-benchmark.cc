@@ -0,0 +1,136 @@
+#include <nexus/test.hh>
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include <clean-core/allocator.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+enum class op_kind
+{
+    alloc,
+    realloc,
+    free
+};
+
+// one step of the replayed trace, idx is the slot in the live set the op works on
+struct trace_op
+{
+    op_kind kind;
+    size_t idx;
+    size_t size;
+};
+
+struct live_block
+{
+    void* ptr;
+    size_t size;
+};
+
+// generated up front so that the rng and the live set simulation are not part of the measured calls
+std::vector<trace_op> make_trace(size_t ops)
+{
+    tg::rng rng;
+    std::vector<trace_op> trace;
+    trace.reserve(ops);
+
+    auto const random_size = [&] {
+        // mostly small blocks, sometimes large ones
+        return uniform(rng, 0, 9) < 8 ? size_t(uniform(rng, 16, 256)) : size_t(uniform(rng, 1024, 64 * 1024));
+    };
+
+    size_t live_count = 0;
+    for (size_t i = 0; i < ops; ++i)
+    {
+        // keeps the live set around 10k blocks once warmed up
+        auto const op = live_count < 10'000 ? 0 : uniform(rng, 0, 2);
+        if (op == 0)
+            trace.push_back({op_kind::alloc, live_count++, random_size()});
+        else if (op == 1)
+            trace.push_back({op_kind::realloc, uniform(rng, size_t(0), live_count - 1), random_size()});
+        else
+            trace.push_back({op_kind::free, uniform(rng, size_t(0), --live_count), 0});
+    }
+    return trace;
+}
+
+// replays the trace against an allocator and records the cycles of every single call
+// only the allocator call itself is between the two cycle reads, the live set bookkeeping is done outside
+// reports percentiles instead of the mean, as we are interested in tail latency
+template <class AllocF, class ReallocF, class FreeF>
+void measure_latency(std::string const& name, std::vector<trace_op> const& trace, AllocF&& alloc, ReallocF&& realloc, FreeF&& free)
+{
+    std::vector<live_block> live(trace.size());
+    std::vector<uint64_t> cycles(trace.size());
+    size_t live_count = 0;
+
+    for (size_t i = 0; i < trace.size(); ++i)
+    {
+        auto const& op = trace[i];
+        auto& b = live[op.idx];
+
+        if (op.kind == op_kind::alloc)
+        {
+            auto const c = ct::current_cycles();
+            auto const p = alloc(op.size);
+            cycles[i] = ct::current_cycles() - c;
+
+            b = {p, op.size};
+            ++live_count;
+        }
+        else if (op.kind == op_kind::realloc)
+        {
+            auto const c = ct::current_cycles();
+            auto const p = realloc(b.ptr, b.size, op.size);
+            cycles[i] = ct::current_cycles() - c;
+
+            b = {p, op.size};
+        }
+        else
+        {
+            auto const c = ct::current_cycles();
+            free(b.ptr);
+            cycles[i] = ct::current_cycles() - c;
+
+            // swap-remove, matches the live count simulated in make_trace
+            b = live[--live_count];
+        }
+    }
+
+    for (size_t i = 0; i < live_count; ++i)
+        free(live[i].ptr);
+
+    std::sort(cycles.begin(), cycles.end());
+    auto const percentile = [&](double p) { return cycles[std::min(cycles.size() - 1, size_t(p * cycles.size()))]; };
+    std::cout << name << ": p50 " << percentile(0.5) << ", p99 " << percentile(0.99) << ", p99.9 " << percentile(0.999) << ", max "
+              << cycles.back() << " cycles / op" << std::endl;
+}
+}
+
+TEST("allocator latency benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    // both allocators replay exactly the same trace
+    auto const trace = make_trace(1'000'000);
+
+    measure_latency(
+        "malloc/realloc/free", trace, [](size_t s) { return std::malloc(s); }, [](void* p, size_t, size_t s) { return std::realloc(p, s); },
+        [](void* p) { std::free(p); });
+
+    measure_latency(
+        "cc::system_allocator", trace, [](size_t s) -> void* { return cc::system_allocator->alloc(s); },
+        [](void* p, size_t old_size, size_t new_size) -> void* { return cc::system_allocator->realloc(p, old_size, new_size); },
+        [](void* p) { cc::system_allocator->free(p); });
+}
@@ -0,0 +1,80 @@
+#include <nexus/test.hh>
+
+#include <clean-core/map.hh>
+#include <clean-core/string.hh>
+#include <clean-core/string_view.hh>
+#include <clean-core/to_string.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+TEST("string key lookup benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+
+    // repeated identifiers, e.g. resource names or ui ids
+    cc::vector<cc::string> names;
+    for (auto i = 0; i < 1000; ++i)
+        names.push_back("resources/textures/material_" + cc::to_string(i) + "/albedo");
+
+    cc::vector<cc::string> queries;
+    for (auto i = 0; i < 1'000'000; ++i)
+        queries.push_back(names[uniform(rng, 0, int(names.size()) - 1)]);
+
+    // string keys: hash + full compare on every lookup
+    {
+        cc::map<cc::string, int> m;
+        for (auto i = 0; i < int(names.size()); ++i)
+            m[names[i]] = i;
+
+        measure("cc::map<cc::string, int> lookup", queries.size(), [&] {
+            auto sum = 0;
+            for (auto const& q : queries)
+                sum += m[q];
+            ct::sink << sum;
+        });
+
+        cc::vector<cc::string_view> views;
+        for (auto const& q : queries)
+            views.push_back(q);
+
+        measure("cc::map<cc::string, int> lookup via string_view", views.size(), [&] {
+            auto sum = 0;
+            for (auto sv : views)
+                sum += m[cc::string(sv)];
+            ct::sink << sum;
+        });
+    }
+
+    // interned keys: the identifier is resolved to a small id once, lookups then only touch integers
+    // (upper bound for an atom type with precomputed hash and pointer equality)
+    {
+        cc::map<cc::string, int> ids;
+        for (auto i = 0; i < int(names.size()); ++i)
+            ids[names[i]] = i;
+
+        cc::vector<int> interned;
+        for (auto const& q : queries)
+            interned.push_back(ids[q]);
+
+        cc::map<int, int> m;
+        for (auto i = 0; i < int(names.size()); ++i)
+            m[i] = i;
+
+        measure("cc::map<int, int> lookup (interned)", interned.size(), [&] {
+            auto sum = 0;
+            for (auto id : interned)
+                sum += m[id];
+            ct::sink << sum;
+        });
+    }
+}
@@ -0,0 +1,37 @@
+#include <nexus/test.hh>
+
+#include <clean-core/base64.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+TEST("cc::base64 benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+
+    // from mesh-sized to texture-sized blobs
+    for (auto size : {4 << 10, 1 << 20, 64 << 20})
+    {
+        auto bytes = cc::vector<cc::byte>::defaulted(size);
+        for (auto& c : bytes)
+            c = cc::byte(uniform(rng, 0, 255));
+
+        auto const encoded = cc::base64_encode(bytes);
+        CHECK(cc::base64_decode(encoded) == bytes);
+
+        std::cout << "== " << size << " bytes ==" << std::endl;
+
+        // throughput is reported relative to the binary size for both directions
+        measure_throughput("cc::base64_encode", size_t(size), [&] { ct::sink << cc::base64_encode(bytes).size(); });
+        measure_throughput("cc::base64_decode", size_t(size), [&] { ct::sink << cc::base64_decode(encoded).size(); });
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ctracer/benchmark.hh>
+
+// shared helpers for the *-benchmark.cc tests
+// each benchmark file has its own DO_BENCHMARK switch and returns early unless it is set
+
+// runs f a few times and reports the cycles per sample of the last (warm) run
+// cleanup is called after each run and is not measured
+template <class F, class C>
+void measure(std::string const& name, size_t samples, F&& f, C&& cleanup)
+{
+    constexpr auto cnt = 3;
+    uint64_t cycles[cnt];
+    for (auto i = 0; i < cnt; ++i)
+    {
+        auto c = ct::current_cycles();
+        f();
+        cycles[i] = (ct::current_cycles() - c) / (samples > 0 ? samples : 1);
+        cleanup();
+    }
+    std::cout << name << ": " << cycles[cnt - 1] << " cycles / sample" << std::endl;
+}
+template <class F>
+void measure(std::string const& name, size_t samples, F&& f)
+{
+    return measure(name, samples, f, [] {});
+}
+
+// starts f(thread_idx) on all threads at once and returns the wall time until all of them finished in ns
+template <class F>
+double run_threads(int num_threads, F&& f)
+{
+    std::atomic<int> ready = 0;
+    std::atomic<bool> go = false;
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < num_threads; ++t)
+        threads.emplace_back([&, t] {
+            ++ready;
+            while (!go)
+                std::this_thread::yield();
+            f(t);
+        });
+
+    while (ready < num_threads)
+        std::this_thread::yield();
+
+    auto const start = std::chrono::high_resolution_clock::now();
+    go = true;
+    for (auto& t : threads)
+        t.join();
+    auto const end = std::chrono::high_resolution_clock::now();
+
+    return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+// reports wall time per op and total throughput when every thread performs ops_per_thread ops
+template <class F>
+void measure_threads(std::string const& name, int num_threads, size_t ops_per_thread, F&& f)
+{
+    auto const ns = run_threads(num_threads, f);
+    auto const total_ops = double(ops_per_thread) * num_threads;
+    std::cout << name << ": " << ns / ops_per_thread << " ns / op per thread, " << total_ops / ns * 1000 << " Mops / s total" << std::endl;
+}
+
+// reports wall time per item when the threads cooperate on items in total (e.g. producers and consumers)
+template <class F>
+void measure_items(std::string const& name, int num_threads, size_t items, F&& f)
+{
+    auto const ns = run_threads(num_threads, f);
+    std::cout << name << ": " << ns / items << " ns / item, " << double(items) / ns * 1000 << " Mitems / s" << std::endl;
+}
+
+// runs f a few times and reports the throughput of the fastest run in GB/s
+template <class F>
+void measure_throughput(std::string const& name, size_t bytes, F&& f)
+{
+    constexpr auto cnt = 3;
+    double best_ns = 0;
+    for (auto i = 0; i < cnt; ++i)
+    {
+        auto const start = std::chrono::high_resolution_clock::now();
+        f();
+        auto const end = std::chrono::high_resolution_clock::now();
+
+        auto const ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        if (i == 0 || ns < best_ns)
+            best_ns = ns;
+    }
+    std::cout << name << ": " << double(bytes) / best_ns << " GB / s" << std::endl;
+}
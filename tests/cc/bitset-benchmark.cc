@@ -0,0 +1,149 @@
+#include <nexus/test.hh>
+
+#include <vector>
+
+#include <clean-core/bits.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// NOTE: 64M flags, e.g. per-triangle visibility or deleted-element masks of a large mesh
+constexpr int bit_count = 1 << 26;
+constexpr int word_count = bit_count / 64;
+
+// ~3% set, sparse like typical visibility or deletion masks
+bool random_bit(tg::rng& rng) { return uniform(rng, 0, 31) == 0; }
+
+cc::vector<cc::uint64> to_words(cc::vector<bool> const& bits)
+{
+    auto words = cc::vector<cc::uint64>::filled(word_count, 0);
+    for (auto i = 0; i < bit_count; ++i)
+        if (bits[i])
+            words[i / 64] |= cc::uint64(1) << (i % 64);
+    return words;
+}
+}
+
+TEST("cc::bitset benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+
+    // what we use today: one byte per flag
+    auto bools_a = cc::vector<bool>::filled(bit_count, false);
+    auto bools_b = cc::vector<bool>::filled(bit_count, false);
+    std::vector<bool> std_a(bit_count);
+    std::vector<bool> std_b(bit_count);
+    for (auto i = 0; i < bit_count; ++i)
+    {
+        auto const a = random_bit(rng);
+        auto const b = random_bit(rng);
+        bools_a[i] = a;
+        bools_b[i] = b;
+        std_a[i] = a;
+        std_b[i] = b;
+    }
+
+    // reference: packed 64 bit words with the scalar cc bit ops
+    auto words_a = to_words(bools_a);
+    auto words_b = to_words(bools_b);
+
+    // bulk and
+    measure("cc::vector<bool> and", bit_count, [&] {
+        for (auto i = 0; i < bit_count; ++i)
+            bools_a[i] = bools_a[i] && bools_b[i];
+    });
+    measure("std::vector<bool> and", bit_count, [&] {
+        for (auto i = 0; i < bit_count; ++i)
+            std_a[i] = std_a[i] && std_b[i];
+    });
+    measure("uint64 words and", bit_count, [&] {
+        for (auto i = 0; i < word_count; ++i)
+            words_a[i] &= words_b[i];
+    });
+
+    // count
+    measure("cc::vector<bool> count", bit_count, [&] {
+        auto cnt = 0;
+        for (auto b : bools_b)
+            cnt += b;
+        ct::sink << cnt;
+    });
+    measure("std::vector<bool> count", bit_count, [&] {
+        auto cnt = 0;
+        for (auto i = 0; i < bit_count; ++i)
+            cnt += std_b[i];
+        ct::sink << cnt;
+    });
+    measure("uint64 words cc::popcount", bit_count, [&] {
+        auto cnt = 0;
+        for (auto w : words_b)
+            cnt += cc::popcount(w);
+        ct::sink << cnt;
+    });
+
+    // iterate set bits
+    measure("cc::vector<bool> iterate set", bit_count, [&] {
+        cc::uint64 sum = 0;
+        for (auto i = 0; i < bit_count; ++i)
+            if (bools_b[i])
+                sum += i;
+        ct::sink << sum;
+    });
+    measure("uint64 words iterate set (ctz)", bit_count, [&] {
+        cc::uint64 sum = 0;
+        for (auto i = 0; i < word_count; ++i)
+            for (auto w = words_b[i]; w != 0; w &= w - 1)
+                sum += i * 64 + cc::count_trailing_zeros(w);
+        ct::sink << sum;
+    });
+
+    // rank(i) = number of set bits before i
+    {
+        cc::vector<int> queries;
+        // NOTE: few queries, the linear scan touches half the words on average
+        for (auto i = 0; i < 1'000; ++i)
+            queries.push_back(uniform(rng, 0, bit_count - 1));
+
+        measure("rank via popcount scan", queries.size(), [&] {
+            cc::uint64 sum = 0;
+            for (auto q : queries)
+            {
+                auto r = 0;
+                for (auto i = 0; i < q / 64; ++i)
+                    r += cc::popcount(words_b[i]);
+                if (q % 64 != 0)
+                    r += cc::popcount(words_b[q / 64] << (64 - q % 64));
+                sum += r;
+            }
+            ct::sink << sum;
+        });
+
+        // one cumulative count per word, +50% memory but O(1)
+        auto word_ranks = cc::vector<int>::filled(word_count, 0);
+        for (auto i = 1; i < word_count; ++i)
+            word_ranks[i] = word_ranks[i - 1] + cc::popcount(words_b[i - 1]);
+
+        measure("rank via per-word prefix counts", queries.size(), [&] {
+            cc::uint64 sum = 0;
+            for (auto q : queries)
+            {
+                auto r = word_ranks[q / 64];
+                if (q % 64 != 0)
+                    r += cc::popcount(words_b[q / 64] << (64 - q % 64));
+                sum += r;
+            }
+            ct::sink << sum;
+        });
+    }
+}
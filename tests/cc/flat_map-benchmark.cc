@@ -0,0 +1,165 @@
+#include <nexus/test.hh>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include <clean-core/bits.hh>
+#include <clean-core/map.hh>
+#include <clean-core/string.hh>
+#include <clean-core/to_string.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// build once, sort + dedup, then only read
+template <class K, class Less = std::less<>>
+cc::vector<K> make_sorted(cc::vector<K> keys, Less less = {})
+{
+    std::sort(keys.begin(), keys.end(), less);
+    keys.resize(size_t(std::unique(keys.begin(), keys.end()) - keys.begin()));
+    return keys;
+}
+
+// fixed number of halvings, compiles to cmov instead of a mispredicted branch per level
+int const* branchless_lower_bound(int const* data, size_t size, int key)
+{
+    auto base = data;
+    while (size > 1)
+    {
+        auto const half = size / 2;
+        base = base[half] < key ? base + half : base;
+        size -= half;
+    }
+    return base + (*base < key ? 1 : 0);
+}
+
+// BFS order (children of i at 2i and 2i+1), the first levels share cache lines
+void build_eytzinger(cc::vector<int> const& sorted, cc::vector<int>& out, size_t& i, size_t k = 1)
+{
+    if (k <= sorted.size())
+    {
+        build_eytzinger(sorted, out, i, 2 * k);
+        out[k] = sorted[i++];
+        build_eytzinger(sorted, out, i, 2 * k + 1);
+    }
+}
+
+bool eytzinger_contains(cc::vector<int> const& e, int key)
+{
+    size_t k = 1;
+    auto const n = e.size() - 1;
+    while (k <= n)
+        k = 2 * k + (e[k] < key ? 1 : 0);
+    // undo the trailing right turns to recover the lower_bound
+    k >>= cc::count_trailing_zeros(cc::uint64(~k)) + 1;
+    return k != 0 && e[k] == key;
+}
+
+void bench_int_keys(tg::rng& rng, int size)
+{
+    cc::vector<int> keys;
+    for (auto i = 0; i < size; ++i)
+        keys.push_back(uniform(rng, 0, 1 << 29) * 2);
+    auto const sorted = make_sorted(keys);
+
+    // every lookup is a hit, in random order
+    cc::vector<int> queries;
+    for (auto i = 0; i < 1'000'000; ++i)
+        queries.push_back(sorted[uniform(rng, 0, int(sorted.size()) - 1)]);
+
+    auto const prefix = "[" + std::to_string(size) + "] ";
+
+    cc::map<int, int> m;
+    for (auto k : sorted)
+        m[k] = 1;
+    measure(prefix + "cc::map<int, int>", queries.size(), [&] {
+        auto cnt = 0;
+        for (auto q : queries)
+            cnt += m.contains_key(q);
+        ct::sink << cnt;
+    });
+
+    measure(prefix + "sorted vector std::lower_bound", queries.size(), [&] {
+        auto cnt = 0;
+        for (auto q : queries)
+        {
+            auto it = std::lower_bound(sorted.begin(), sorted.end(), q);
+            cnt += it != sorted.end() && *it == q;
+        }
+        ct::sink << cnt;
+    });
+
+    measure(prefix + "sorted vector branchless", queries.size(), [&] {
+        auto cnt = 0;
+        for (auto q : queries)
+        {
+            auto it = branchless_lower_bound(sorted.data(), sorted.size(), q);
+            cnt += it != sorted.data() + sorted.size() && *it == q;
+        }
+        ct::sink << cnt;
+    });
+
+    auto eytzinger = cc::vector<int>::defaulted(sorted.size() + 1);
+    size_t idx = 0;
+    build_eytzinger(sorted, eytzinger, idx);
+    measure(prefix + "eytzinger", queries.size(), [&] {
+        auto cnt = 0;
+        for (auto q : queries)
+            cnt += eytzinger_contains(eytzinger, q);
+        ct::sink << cnt;
+    });
+}
+}
+
+TEST("cc::flat_map read-mostly benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+
+    // NOTE: small option tables up to tables that no longer fit into L2
+    for (auto size : {32, 1'000, 100'000, 10'000'000})
+        bench_int_keys(rng, size);
+
+    // string keys, e.g. command line options or obj group names
+    {
+        cc::vector<cc::string> names;
+        for (auto i = 0; i < 64; ++i)
+            names.push_back("--option-" + cc::to_string(uniform(rng, 0, 1'000'000)));
+        auto const less = [](cc::string const& a, cc::string const& b) { return std::strcmp(a.c_str(), b.c_str()) < 0; };
+        auto const sorted = make_sorted(names, less);
+
+        cc::vector<cc::string> queries;
+        for (auto i = 0; i < 1'000'000; ++i)
+            queries.push_back(sorted[uniform(rng, 0, int(sorted.size()) - 1)]);
+
+        cc::map<cc::string, int> m;
+        for (auto const& n : sorted)
+            m[n] = 1;
+        measure("[64] cc::map<cc::string, int>", queries.size(), [&] {
+            auto cnt = 0;
+            for (auto const& q : queries)
+                cnt += m.contains_key(q);
+            ct::sink << cnt;
+        });
+        measure("[64] sorted cc::vector<cc::string> std::lower_bound", queries.size(), [&] {
+            auto cnt = 0;
+            for (auto const& q : queries)
+            {
+                auto it = std::lower_bound(sorted.begin(), sorted.end(), q, less);
+                cnt += it != sorted.end() && *it == q;
+            }
+            ct::sink << cnt;
+        });
+    }
+}
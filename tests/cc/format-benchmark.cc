@@ -0,0 +1,65 @@
+#include <nexus/test.hh>
+
+#include <cstdio>
+
+#include <clean-core/format.hh>
+#include <clean-core/string.hh>
+#include <clean-core/string_stream.hh>
+#include <clean-core/to_string.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+TEST("cc::format benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    using namespace cc::format_literals;
+
+    constexpr int count = 100'000;
+
+    // typical log line shapes
+    measure("cc::format (positional)", count, [&] {
+        for (auto i = 0; i < count; ++i)
+            ct::sink << cc::format("frame {} took {} ms on thread {}", i, 16.6f, "main").size();
+    });
+    measure("cc::format (named)", count, [&] {
+        for (auto i = 0; i < count; ++i)
+            ct::sink << cc::format("frame {f} took {t} ms on thread {n}", "f"_a = i, "t"_a = 16.6f, "n"_a = "main").size();
+    });
+    measure("cc::format (spec)", count, [&] {
+        for (auto i = 0; i < count; ++i)
+            ct::sink << cc::format("{:>10} {:x} {:.3f}", "id", i, 16.6).size();
+    });
+
+    // no allocation per call, the format string is still parsed at runtime
+    measure("std::snprintf", count, [&] {
+        char buffer[128];
+        for (auto i = 0; i < count; ++i)
+            ct::sink << std::snprintf(buffer, sizeof(buffer), "frame %d took %f ms on thread %s", i, 16.6f, "main");
+    });
+
+    // appending to a reused sink, what a format_to(stream) would write into
+    measure("cc::string_stream <<", count, [&] {
+        cc::string_stream ss;
+        for (auto i = 0; i < count; ++i)
+        {
+            ss << "frame " << cc::to_string(i) << " took " << cc::to_string(16.6f) << " ms on thread main";
+            ss.clear();
+        }
+        ct::sink << ss.size();
+    });
+    measure("cc::string_stream << cc::format", count, [&] {
+        cc::string_stream ss;
+        for (auto i = 0; i < count; ++i)
+        {
+            ss << cc::format("frame {} took {} ms on thread {}", i, 16.6f, "main");
+            ss.clear();
+        }
+        ct::sink << ss.size();
+    });
+}
@@ -0,0 +1,106 @@
+#include <nexus/test.hh>
+
+#include <cstdlib>
+
+#include <clean-core/from_string.hh>
+#include <clean-core/string.hh>
+#include <clean-core/string_view.hh>
+#include <clean-core/to_string.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// NOTE: ~100 MB of text by default, increase for multi-GB runs
+constexpr int number_count = 10'000'000;
+
+// newline separated numbers, like the columns of an ascii PCD file
+template <class T, class F>
+cc::string make_text(tg::rng& rng, F&& gen)
+{
+    cc::string text;
+    for (auto i = 0; i < number_count; ++i)
+    {
+        text += cc::to_string(T(gen(rng)));
+        text += '\n';
+    }
+    return text;
+}
+
+// splits into tokens up front so that only the number parsing is measured
+cc::vector<cc::string_view> tokenize(cc::string const& text)
+{
+    cc::vector<cc::string_view> tokens;
+    auto const* begin = text.data();
+    auto const* end = text.data() + text.size();
+    for (auto p = begin; p != end; ++p)
+        if (*p == '\n')
+        {
+            tokens.push_back(cc::string_view(begin, size_t(p - begin)));
+            begin = p + 1;
+        }
+    return tokens;
+}
+
+template <class T>
+void bench_from_string(std::string const& name, cc::vector<cc::string_view> const& tokens)
+{
+    measure(name, tokens.size(), [&] {
+        // double for every T, an int sum over 10M values would overflow
+        double sum = 0;
+        T v = 0;
+        for (auto t : tokens)
+            if (cc::from_string(t, v))
+                sum += double(v);
+        ct::sink << sum;
+    });
+}
+
+// the C functions already return the end pointer and can be chained over the whole buffer
+template <class F>
+void bench_strto(std::string const& name, cc::string const& text, F&& parse)
+{
+    measure(name, number_count, [&] {
+        double sum = 0;
+        char const* p = text.c_str();
+        char* end = nullptr;
+        for (auto i = 0; i < number_count; ++i)
+        {
+            sum += parse(p, &end);
+            p = end;
+        }
+        ct::sink << sum;
+    });
+}
+}
+
+TEST("cc::from_string benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+
+    auto const int_text = make_text<int>(rng, [](tg::rng& rng) { return uniform(rng, -1'000'000, 1'000'000); });
+    auto const float_text = make_text<float>(rng, [](tg::rng& rng) { return uniform(rng, -100.f, 100.f); });
+    auto const double_text = make_text<double>(rng, [](tg::rng& rng) { return uniform(rng, -1e6, 1e6); });
+
+    auto const int_tokens = tokenize(int_text);
+    auto const float_tokens = tokenize(float_text);
+    auto const double_tokens = tokenize(double_text);
+
+    bench_from_string<int>("cc::from_string int", int_tokens);
+    bench_from_string<float>("cc::from_string float", float_tokens);
+    bench_from_string<double>("cc::from_string double", double_tokens);
+
+    bench_strto("std::strtol", int_text, [](char const* p, char** end) { return double(std::strtol(p, end, 10)); });
+    bench_strto("std::strtof", float_text, [](char const* p, char** end) { return double(std::strtof(p, end)); });
+    bench_strto("std::strtod", double_text, [](char const* p, char** end) { return std::strtod(p, end); });
+}
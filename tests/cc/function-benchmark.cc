@@ -0,0 +1,104 @@
+#include <nexus/test.hh>
+
+#include <cstdint>
+#include <functional>
+
+#include <clean-core/function_ref.hh>
+#include <clean-core/unique_function.hh>
+#include <clean-core/vector.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+constexpr int count = 1'000'000;
+
+// lambda state of a given size, e.g. a td task capturing a few pointers vs. a res::define callback capturing a config
+template <int Bytes>
+struct capture
+{
+    int data[Bytes / sizeof(int)];
+};
+
+template <class function_t, class L>
+void bench_function(std::string const& name, L const& lambda)
+{
+    cc::vector<function_t> funcs;
+    funcs.reserve(count);
+
+    // includes the heap allocation for captures that do not fit inline
+    measure(
+        name + " construct", count,
+        [&] {
+            for (auto i = 0; i < count; ++i)
+                funcs.emplace_back(lambda);
+        },
+        [&] { funcs.clear(); });
+
+    for (auto i = 0; i < count; ++i)
+        funcs.emplace_back(lambda);
+
+    cc::vector<function_t> moved;
+    moved.reserve(count);
+    measure(
+        name + " move", count,
+        [&] {
+            for (auto& f : funcs)
+                moved.push_back(cc::move(f));
+        },
+        [&] {
+            funcs.clear();
+            for (auto& f : moved)
+                funcs.push_back(cc::move(f));
+            moved.clear();
+        });
+
+    measure(name + " invoke", count, [&] {
+        int64_t sum = 0;
+        auto i = 0;
+        for (auto& f : funcs)
+            sum += f(i++);
+        ct::sink << sum;
+    });
+}
+
+template <int Bytes>
+void bench_capture_size()
+{
+    capture<Bytes> c = {};
+    c.data[0] = 1;
+    auto const lambda = [c](int i) { return i + c.data[0]; };
+    auto const prefix = "[" + std::to_string(Bytes) + " B capture] ";
+
+    bench_function<cc::unique_function<int(int)>>(prefix + "cc::unique_function", lambda);
+    bench_function<std::function<int(int)>>(prefix + "std::function", lambda);
+
+    // non-owning reference point: never allocates, but cannot outlive the lambda
+    measure(prefix + "cc::function_ref construct + invoke", count, [&] {
+        int64_t sum = 0;
+        for (auto i = 0; i < count; ++i)
+        {
+            cc::function_ref<int(int)> f = lambda;
+            sum += f(i);
+        }
+        ct::sink << sum;
+    });
+}
+}
+
+TEST("cc::unique_function benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    // NOTE: spans the inline capacities of common std::function implementations (16 - 32 B) and beyond
+    bench_capture_size<8>();
+    bench_capture_size<16>();
+    bench_capture_size<32>();
+    bench_capture_size<64>();
+    bench_capture_size<128>();
+}
@@ -0,0 +1,85 @@
+#include <nexus/test.hh>
+
+#include <cstring>
+#include <functional>
+#include <string_view>
+
+#include <clean-core/hash.hh>
+#include <clean-core/span.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// what hashing a byte buffer looks like with the current API: one hash_combine per 8 byte word
+cc::uint64 hash_words(cc::span<cc::byte const> bytes)
+{
+    auto h = cc::hash_combine();
+    auto const word_cnt = bytes.size() / sizeof(cc::uint64);
+    for (size_t i = 0; i < word_cnt; ++i)
+    {
+        cc::uint64 w;
+        std::memcpy(&w, bytes.data() + i * sizeof(cc::uint64), sizeof(w));
+        h = cc::hash_combine(h, w);
+    }
+    for (auto i = word_cnt * sizeof(cc::uint64); i < bytes.size(); ++i)
+        h = cc::hash_combine(h, cc::uint64(bytes[i]));
+    return h;
+}
+
+// byte-at-a-time reference
+cc::uint64 hash_fnv1a(cc::span<cc::byte const> bytes)
+{
+    cc::uint64 h = 0xcbf29ce484222325uLL;
+    for (auto b : bytes)
+    {
+        h ^= cc::uint64(b);
+        h *= 0x100000001b3uLL;
+    }
+    return h;
+}
+}
+
+TEST("byte hashing benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+
+    for (auto size : {64, 4 << 10, 1 << 20, 64 << 20})
+    {
+        auto bytes = cc::vector<cc::byte>::defaulted(size);
+        for (auto& c : bytes)
+            c = cc::byte(uniform(rng, 0, 255));
+
+        auto const data = cc::span<cc::byte const>(bytes);
+        auto const sv = std::string_view(reinterpret_cast<char const*>(bytes.data()), bytes.size());
+
+        // small inputs are repeated so that each run hashes at least 64 MB
+        auto const reps = size_t((64 << 20) / size);
+        auto const total = reps * size_t(size);
+
+        std::cout << "== " << size << " bytes ==" << std::endl;
+
+        measure_throughput("cc::hash_combine per word", total, [&] {
+            for (size_t r = 0; r < reps; ++r)
+                ct::sink << hash_words(data);
+        });
+        measure_throughput("fnv-1a per byte", total, [&] {
+            for (size_t r = 0; r < reps; ++r)
+                ct::sink << hash_fnv1a(data);
+        });
+        measure_throughput("std::hash<std::string_view>", total, [&] {
+            for (size_t r = 0; r < reps; ++r)
+                ct::sink << std::hash<std::string_view>()(sv);
+        });
+    }
+}
@@ -0,0 +1,142 @@
+#include <nexus/test.hh>
+
+#include <string>
+#include <unordered_map>
+
+#include <clean-core/map.hh>
+#include <clean-core/string.hh>
+#include <clean-core/string_view.hh>
+#include <clean-core/to_string.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// uniform access so that all map types run exactly the same loops
+template <class K, class V>
+bool map_contains(cc::map<K, V> const& m, K const& k)
+{
+    return m.contains_key(k);
+}
+template <class K, class V>
+bool map_contains(std::unordered_map<K, V> const& m, K const& k)
+{
+    return m.count(k) != 0;
+}
+template <class K, class V>
+void map_remove(cc::map<K, V>& m, K const& k)
+{
+    m.remove_key(k);
+}
+template <class K, class V>
+void map_remove(std::unordered_map<K, V>& m, K const& k)
+{
+    m.erase(k);
+}
+
+template <class map_t, class key_t>
+void bench_map(std::string const& name, cc::vector<key_t> const& keys, cc::vector<key_t> const& misses)
+{
+    map_t m;
+
+    measure(
+        name + " insert", keys.size(),
+        [&] {
+            for (auto const& k : keys)
+                m[k] = 1;
+        },
+        [&] { m.clear(); });
+
+    for (auto const& k : keys)
+        m[k] = 1;
+
+    measure(name + " lookup (hit)", keys.size(), [&] {
+        for (auto const& k : keys)
+            ct::sink << map_contains(m, k);
+    });
+    measure(name + " lookup (miss)", misses.size(), [&] {
+        for (auto const& k : misses)
+            ct::sink << map_contains(m, k);
+    });
+    measure(name + " op[] (hit)", keys.size(), [&] {
+        for (auto const& k : keys)
+            ct::sink << m[k];
+    });
+    measure(name + " iterate", keys.size(), [&] {
+        auto sum = 0;
+        for (auto&& [k, v] : m)
+            sum += v;
+        ct::sink << sum;
+    });
+    measure(name + " remove + insert", keys.size(), [&] {
+        for (auto const& k : keys)
+        {
+            map_remove(m, k);
+            m[k] = 2;
+        }
+    });
+}
+}
+
+TEST("cc::map benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+
+    // NOTE: sizes chosen so that the large tables no longer fit into L2
+    for (auto size : {100, 10'000, 1'000'000})
+    {
+        std::cout << "== " << size << " entries ==" << std::endl;
+
+        cc::vector<int> keys;
+        cc::vector<int> misses;
+        for (auto i = 0; i < size; ++i)
+        {
+            keys.push_back(uniform(rng, 0, 1 << 29) * 2);
+            misses.push_back(uniform(rng, 0, 1 << 29) * 2 + 1);
+        }
+
+        bench_map<cc::map<int, int>>("cc::map<int, int>", keys, misses);
+        bench_map<std::unordered_map<int, int>>("std::unordered_map<int, int>", keys, misses);
+
+        cc::vector<cc::string> skeys;
+        cc::vector<cc::string> smisses;
+        cc::vector<std::string> std_skeys;
+        cc::vector<std::string> std_smisses;
+        for (auto i = 0; i < size; ++i)
+        {
+            skeys.push_back("entity/" + cc::to_string(keys[i]));
+            smisses.push_back("entity/" + cc::to_string(misses[i]));
+            std_skeys.push_back(skeys.back().c_str());
+            std_smisses.push_back(smisses.back().c_str());
+        }
+
+        bench_map<cc::map<cc::string, int>>("cc::map<cc::string, int>", skeys, smisses);
+        bench_map<std::unordered_map<std::string, int>>("std::unordered_map<std::string, int>", std_skeys, std_smisses);
+
+        // string_view keys currently have to be converted to a cc::string before each lookup
+        {
+            cc::map<cc::string, int> m;
+            for (auto const& k : skeys)
+                m[k] = 1;
+
+            cc::vector<cc::string_view> views;
+            for (auto const& k : skeys)
+                views.push_back(cc::string_view(k));
+
+            measure("cc::map<cc::string, int> lookup via string_view", views.size(), [&] {
+                for (auto sv : views)
+                    ct::sink << m.contains_key(cc::string(sv));
+            });
+        }
+    }
+}
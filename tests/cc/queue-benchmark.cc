@@ -0,0 +1,170 @@
+#include <nexus/test.hh>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include <clean-core/span.hh>
+#include <clean-core/vector.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// the hand-rolled queue we currently use between threads: bounded, one lock, blocking via condition variables
+template <class T>
+struct locked_queue
+{
+    explicit locked_queue(size_t capacity) : _capacity(capacity) {}
+
+    void push(T const& v)
+    {
+        std::unique_lock lock(_mutex);
+        _not_full.wait(lock, [&] { return _items.size() < _capacity; });
+        _items.push_back(v);
+        lock.unlock();
+        _not_empty.notify_one();
+    }
+    T pop()
+    {
+        std::unique_lock lock(_mutex);
+        _not_empty.wait(lock, [&] { return !_items.empty(); });
+        auto v = _items.front();
+        _items.pop_front();
+        lock.unlock();
+        _not_full.notify_one();
+        return v;
+    }
+
+    // one lock per batch, blocks until at least one element could be pushed / popped
+    size_t push_batch(cc::span<T const> values)
+    {
+        std::unique_lock lock(_mutex);
+        _not_full.wait(lock, [&] { return _items.size() < _capacity; });
+        size_t cnt = 0;
+        while (cnt < values.size() && _items.size() < _capacity)
+            _items.push_back(values[cnt++]);
+        lock.unlock();
+        _not_empty.notify_all();
+        return cnt;
+    }
+    size_t pop_batch(cc::span<T> out)
+    {
+        std::unique_lock lock(_mutex);
+        _not_empty.wait(lock, [&] { return !_items.empty(); });
+        size_t cnt = 0;
+        while (cnt < out.size() && !_items.empty())
+        {
+            out[cnt++] = _items.front();
+            _items.pop_front();
+        }
+        lock.unlock();
+        _not_full.notify_all();
+        return cnt;
+    }
+
+private:
+    size_t _capacity;
+    std::deque<T> _items;
+    std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+};
+
+constexpr size_t queue_capacity = 1024;
+constexpr size_t items_per_producer = 1'000'000;
+
+// the first num_producers threads push, the rest pop
+void bench_throughput(int num_producers, int num_consumers)
+{
+    locked_queue<int> q(queue_capacity);
+    auto const total = items_per_producer * num_producers;
+    auto const name = "locked_queue " + std::to_string(num_producers) + "P/" + std::to_string(num_consumers) + "C";
+
+    measure_items(name, num_producers + num_consumers, total, [&](int t) {
+        if (t < num_producers)
+        {
+            for (size_t i = 0; i < items_per_producer; ++i)
+                q.push(1);
+        }
+        else
+        {
+            // consumers split the items evenly, the first one takes the remainder
+            auto const c = t - num_producers;
+            auto cnt = total / num_consumers + (c == 0 ? total % num_consumers : 0);
+            auto sum = 0;
+            while (cnt-- > 0)
+                sum += q.pop();
+            ct::sink << sum;
+        }
+    });
+}
+
+void bench_throughput_batched(size_t batch_size)
+{
+    locked_queue<int> q(queue_capacity);
+    auto const name = "locked_queue 1P/1C batch " + std::to_string(batch_size);
+
+    measure_items(name, 2, items_per_producer, [&](int t) {
+        cc::vector<int> buffer = cc::vector<int>::filled(batch_size, 1);
+        if (t == 0)
+        {
+            size_t pushed = 0;
+            while (pushed < items_per_producer)
+            {
+                auto const cnt = std::min(batch_size, items_per_producer - pushed);
+                pushed += q.push_batch(cc::span<int const>(buffer.data(), cnt));
+            }
+        }
+        else
+        {
+            size_t popped = 0;
+            while (popped < items_per_producer)
+                popped += q.pop_batch(cc::span<int>(buffer.data(), std::min(batch_size, items_per_producer - popped)));
+        }
+    });
+}
+
+// ping-pong between two threads through two queues, reports the round trip
+void bench_latency()
+{
+    constexpr size_t round_trips = 100'000;
+    locked_queue<int> ping(queue_capacity);
+    locked_queue<int> pong(queue_capacity);
+
+    measure_items("locked_queue round trip", 2, round_trips, [&](int t) {
+        for (size_t i = 0; i < round_trips; ++i)
+        {
+            if (t == 0)
+            {
+                ping.push(int(i));
+                ct::sink << pong.pop();
+            }
+            else
+                pong.push(ping.pop());
+        }
+    });
+}
+}
+
+TEST("thread queue benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    bench_throughput(1, 1);
+    bench_throughput(2, 2);
+    bench_throughput(4, 1);
+    bench_throughput(1, 4);
+    bench_throughput(4, 4);
+
+    for (size_t batch_size : {8, 64, 256})
+        bench_throughput_batched(batch_size);
+
+    bench_latency();
+}
@@ -0,0 +1,75 @@
+#include <nexus/test.hh>
+
+#include <clean-core/alloc_vector.hh>
+#include <clean-core/box.hh>
+#include <clean-core/string.hh>
+#include <clean-core/unique_function.hh>
+#include <clean-core/unique_ptr.hh>
+#include <clean-core/vector.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// grows a vector from empty without reserve, so every growth step relocates all elements
+// elements are created up front and destroyed afterwards, only the push_backs (and thus the relocations) are measured
+template <class vector_t, class MakeT>
+void bench_growth(std::string const& name, int count, MakeT&& make_element)
+{
+    using T = std::decay_t<decltype(make_element(0))>;
+
+    cc::vector<cc::vector<T>> sources;
+    for (auto r = 0; r < 3; ++r)
+    {
+        auto& s = sources.emplace_back();
+        s.reserve(count);
+        for (auto i = 0; i < count; ++i)
+            s.push_back(make_element(i));
+    }
+
+    // one target per run, so the element destructors (heap frees for most types) run outside of the measurement
+    vector_t results[3];
+
+    auto run = 0;
+    measure(name, size_t(count), [&] {
+        auto& v = results[run];
+        for (auto& e : sources[run])
+            v.push_back(cc::move(e));
+        ct::sink << v.size();
+        ++run;
+    });
+}
+}
+
+TEST("relocation benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    auto const make_int = [](int i) { return i; };
+    auto const make_string = [](int i) { return cc::string("a string that does not fit into the sso buffer #") + char('a' + i % 26); };
+    auto const make_uptr = [](int i) { return cc::make_unique<int>(i); };
+    auto const make_box = [](int i) { return cc::make_box<int>(i); };
+    auto const make_func = [](int i) { return cc::unique_function<int()>([i] { return i; }); };
+
+    for (auto count : {1'000, 100'000, 1'000'000})
+    {
+        std::cout << "== " << count << " elements ==" << std::endl;
+
+        // trivially copyable baseline (alloc_vector already uses realloc here)
+        bench_growth<cc::vector<int>>("cc::vector<int>", count, make_int);
+        bench_growth<cc::alloc_vector<int>>("cc::alloc_vector<int>", count, make_int);
+
+        // non-trivial but relocatable: currently move-construct + destroy per element and growth step
+        bench_growth<cc::vector<cc::string>>("cc::vector<cc::string>", count, make_string);
+        bench_growth<cc::alloc_vector<cc::string>>("cc::alloc_vector<cc::string>", count, make_string);
+        bench_growth<cc::vector<cc::unique_ptr<int>>>("cc::vector<cc::unique_ptr<int>>", count, make_uptr);
+        bench_growth<cc::alloc_vector<cc::unique_ptr<int>>>("cc::alloc_vector<cc::unique_ptr<int>>", count, make_uptr);
+        bench_growth<cc::vector<cc::box<int>>>("cc::vector<cc::box<int>>", count, make_box);
+        bench_growth<cc::vector<cc::unique_function<int()>>>("cc::vector<cc::unique_function<int()>>", count, make_func);
+    }
+}
@@ -0,0 +1,89 @@
+#include <nexus/test.hh>
+
+#include <clean-core/alloc_vector.hh>
+#include <clean-core/map.hh>
+#include <clean-core/string.hh>
+#include <clean-core/to_string.hh>
+#include <clean-core/vector.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+constexpr int num_requests = 10'000;
+constexpr int items_per_request = 64;
+
+// a typical per-request workload: a few temporary lists, some string building and a lookup table
+// returns something so the work cannot be optimized away
+template <class int_vector_t, class F>
+int process_request(int request, F&& make_int_vector)
+{
+    int_vector_t ids = make_int_vector();
+    int_vector_t values = make_int_vector();
+    for (auto i = 0; i < items_per_request; ++i)
+    {
+        ids.push_back(request * items_per_request + i);
+        values.push_back(i % 7);
+    }
+
+    cc::map<cc::string, int> counts;
+    cc::string log;
+    for (auto i = 0; i < items_per_request; ++i)
+    {
+        auto key = "item/" + cc::to_string(values[i]);
+        counts[key] += ids[i];
+        log += key;
+        log += ';';
+    }
+
+    return int(counts.size() + log.size());
+}
+}
+
+TEST("per-request scratch memory benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    measure("global heap only", num_requests, [&] {
+        auto sum = 0;
+        for (auto r = 0; r < num_requests; ++r)
+            sum += process_request<cc::vector<int>>(r, [] { return cc::vector<int>(); });
+        ct::sink << sum;
+    });
+
+    // lists come from a per-request linear allocator that is dropped in O(1) afterwards
+    // strings and maps have no allocator-aware variant yet and still hit the global heap
+    auto buffer = cc::vector<std::byte>::defaulted(1 << 20);
+    measure("alloc_vector on linear_allocator", num_requests, [&] {
+        auto sum = 0;
+        for (auto r = 0; r < num_requests; ++r)
+        {
+            cc::linear_allocator scratch(buffer);
+            sum += process_request<cc::alloc_vector<int>>(r, [&] { return cc::alloc_vector<int>(&scratch); });
+        }
+        ct::sink << sum;
+    });
+
+    // lower bound: only the list part of the workload, all from the scratch allocator
+    measure("alloc_vector on linear_allocator (lists only)", num_requests, [&] {
+        auto sum = 0;
+        for (auto r = 0; r < num_requests; ++r)
+        {
+            cc::linear_allocator scratch(buffer);
+            cc::alloc_vector<int> ids(&scratch);
+            cc::alloc_vector<int> values(&scratch);
+            for (auto i = 0; i < items_per_request; ++i)
+            {
+                ids.push_back(r * items_per_request + i);
+                values.push_back(i % 7);
+            }
+            sum += int(ids.size() + values.size());
+        }
+        ct::sink << sum;
+    });
+}
@@ -0,0 +1,207 @@
+#include <nexus/test.hh>
+
+#include <cstdint>
+
+#include <clean-core/map.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+struct payload
+{
+    float transform[12];
+    int id;
+};
+
+// minimal generational slot array as reference point for cc::map<int, T>
+// handles are 24 bit slot index + 8 bit generation, values are kept dense for iteration
+struct slot_array
+{
+    using handle = uint32_t;
+
+    handle insert(payload const& v)
+    {
+        uint32_t slot_idx;
+        if (!_free_slots.empty())
+        {
+            slot_idx = _free_slots.back();
+            _free_slots.pop_back();
+        }
+        else
+        {
+            slot_idx = uint32_t(_slots.size());
+            _slots.push_back({0, 0});
+        }
+
+        _slots[slot_idx].dense_idx = uint32_t(_values.size());
+        _values.push_back(v);
+        _dense_to_slot.push_back(slot_idx);
+        return slot_idx | (_slots[slot_idx].generation << 24);
+    }
+
+    payload* get(handle h)
+    {
+        auto const& s = _slots[h & 0xFFFFFF];
+        return s.generation == (h >> 24) ? &_values[s.dense_idx] : nullptr;
+    }
+
+    void erase(handle h)
+    {
+        auto const slot_idx = h & 0xFFFFFF;
+        auto& s = _slots[slot_idx];
+        if (s.generation != (h >> 24))
+            return;
+
+        // swap-remove keeps the values dense
+        auto const last_slot = _dense_to_slot.back();
+        _values[s.dense_idx] = _values.back();
+        _dense_to_slot[s.dense_idx] = last_slot;
+        _slots[last_slot].dense_idx = s.dense_idx;
+        _values.pop_back();
+        _dense_to_slot.pop_back();
+
+        s.generation = (s.generation + 1) & 0xFF;
+        _free_slots.push_back(slot_idx);
+    }
+
+    cc::vector<payload> const& values() const { return _values; }
+
+private:
+    struct slot
+    {
+        uint32_t dense_idx;
+        uint32_t generation;
+    };
+
+    cc::vector<slot> _slots;
+    cc::vector<payload> _values;
+    cc::vector<uint32_t> _dense_to_slot;
+    cc::vector<uint32_t> _free_slots;
+};
+
+// NOTE: typical resource/instance churn: a large live set where a fraction is replaced every frame
+constexpr int live_count = 100'000;
+constexpr int churn_per_frame = 5'000;
+constexpr int frames = 100;
+
+payload make_payload(int id)
+{
+    payload p = {};
+    p.id = id;
+    return p;
+}
+}
+
+TEST("cc::slot_map churn benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+
+    // the random indices into the live set are shared so that both containers see the same workload
+    cc::vector<int> victims;
+    for (auto i = 0; i < frames * churn_per_frame; ++i)
+        victims.push_back(uniform(rng, 0, live_count - 1));
+
+    {
+        cc::map<int, payload> m;
+        cc::vector<int> live;
+        int next_id = 0;
+
+        // initial fill + replacements, i.e. cycles per insert-or-replace
+        measure(
+            "cc::map<int, T> churn", live_count + frames * churn_per_frame,
+            [&] {
+                for (auto i = 0; i < live_count; ++i)
+                {
+                    m[next_id] = make_payload(next_id);
+                    live.push_back(next_id++);
+                }
+
+                auto v = 0;
+                for (auto f = 0; f < frames; ++f)
+                    for (auto i = 0; i < churn_per_frame; ++i)
+                    {
+                        auto& id = live[victims[v++]];
+                        m.remove_key(id);
+                        m[next_id] = make_payload(next_id);
+                        id = next_id++;
+                    }
+            },
+            [&] {
+                m.clear();
+                live.clear();
+            });
+
+        for (auto i = 0; i < live_count; ++i)
+        {
+            m[next_id] = make_payload(next_id);
+            live.push_back(next_id++);
+        }
+
+        measure("cc::map<int, T> lookup", live_count, [&] {
+            int64_t sum = 0;
+            for (auto id : live)
+                sum += m.get(id).id;
+            ct::sink << sum;
+        });
+        measure("cc::map<int, T> iterate", live_count, [&] {
+            int64_t sum = 0;
+            for (auto&& [k, v] : m)
+                sum += v.id;
+            ct::sink << sum;
+        });
+    }
+
+    {
+        slot_array s;
+        cc::vector<slot_array::handle> live;
+        int next_id = 0;
+
+        measure(
+            "slot array churn", live_count + frames * churn_per_frame,
+            [&] {
+                for (auto i = 0; i < live_count; ++i)
+                    live.push_back(s.insert(make_payload(next_id++)));
+
+                auto v = 0;
+                for (auto f = 0; f < frames; ++f)
+                    for (auto i = 0; i < churn_per_frame; ++i)
+                    {
+                        auto& h = live[victims[v++]];
+                        s.erase(h);
+                        h = s.insert(make_payload(next_id++));
+                    }
+            },
+            [&] {
+                for (auto h : live)
+                    s.erase(h);
+                live.clear();
+            });
+
+        for (auto i = 0; i < live_count; ++i)
+            live.push_back(s.insert(make_payload(next_id++)));
+
+        measure("slot array lookup", live_count, [&] {
+            int64_t sum = 0;
+            for (auto h : live)
+                sum += s.get(h)->id;
+            ct::sink << sum;
+        });
+        measure("slot array iterate", live_count, [&] {
+            int64_t sum = 0;
+            for (auto const& v : s.values())
+                sum += v.id;
+            ct::sink << sum;
+        });
+    }
+}
@@ -0,0 +1,77 @@
+#include <nexus/test.hh>
+
+#include <clean-core/string.hh>
+#include <clean-core/string_stream.hh>
+#include <clean-core/string_view.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// NOTE: 256 MB of output, similar to large generated json / html documents
+constexpr size_t output_size = 256 << 20;
+
+// many small appends, as a serializer would emit them
+template <class StreamT>
+void write_document(StreamT& s)
+{
+    cc::string_view const parts[] = {"{\"id\": ", "12345", ", \"name\": \"some entity\", \"tags\": [\"a\", \"b\", \"c\"]},\n"};
+
+    size_t written = 0;
+    while (written < output_size)
+        for (auto p : parts)
+        {
+            s << p;
+            written += p.size();
+        }
+}
+
+struct string_sink
+{
+    cc::string& s;
+    string_sink& operator<<(cc::string_view v)
+    {
+        s += v;
+        return *this;
+    }
+};
+}
+
+TEST("cc::string_stream large output benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    // single growing buffer, repeatedly reallocated
+    measure_throughput("cc::string_stream append", output_size, [&] {
+        cc::string_stream ss;
+        write_document(ss);
+        ct::sink << ss.size();
+    });
+
+    // the final copy when handing the result to a writer
+    {
+        cc::string_stream ss;
+        write_document(ss);
+        measure_throughput("cc::string_stream to_string", ss.size(), [&] { ct::sink << ss.to_string().size(); });
+    }
+
+    // references
+    measure_throughput("cc::string +=", output_size, [&] {
+        cc::string s;
+        string_sink sink{s};
+        write_document(sink);
+        ct::sink << s.size();
+    });
+    measure_throughput("cc::string += (reserved)", output_size, [&] {
+        cc::string s;
+        s.reserve(output_size + 64);
+        string_sink sink{s};
+        write_document(sink);
+        ct::sink << s.size();
+    });
+}
@@ -0,0 +1,144 @@
+#include <nexus/test.hh>
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include <clean-core/string.hh>
+#include <clean-core/string_view.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// NOTE: 256 MB by default, increase to 1 GB+ for log-sized inputs
+constexpr size_t text_size = size_t(256) << 20;
+
+// short lowercase words, ~8 per line, roughly the shape of logs and obj/pcd files
+cc::string make_text(tg::rng& rng)
+{
+    cc::string text;
+    text.reserve(text_size + 64);
+    while (text.size() < text_size)
+    {
+        auto const word_len = uniform(rng, 1, 10);
+        for (auto i = 0; i < word_len; ++i)
+            text += char('a' + uniform(rng, 0, 25));
+        text += uniform(rng, 0, 7) == 0 ? '\n' : ' ';
+    }
+    return text;
+}
+}
+
+TEST("cc::string_view scanning benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+    auto const text = make_text(rng);
+    auto const sv = cc::string_view(text);
+    auto const ssv = std::string_view(text.data(), text.size());
+    auto const bytes = text.size();
+
+    // count(char)
+    measure_throughput("count '\\n' (loop over cc::string_view)", bytes, [&] {
+        size_t cnt = 0;
+        for (auto c : sv)
+            cnt += c == '\n';
+        ct::sink << cnt;
+    });
+    measure_throughput("count '\\n' (std::count)", bytes, [&] { ct::sink << size_t(std::count(sv.begin(), sv.end(), '\n')); });
+    measure_throughput("count '\\n' (memchr)", bytes, [&] {
+        size_t cnt = 0;
+        auto p = text.data();
+        auto const end = text.data() + text.size();
+        while ((p = static_cast<char const*>(std::memchr(p, '\n', size_t(end - p)))) != nullptr)
+        {
+            ++cnt;
+            ++p;
+        }
+        ct::sink << cnt;
+    });
+
+    // find a char that does not occur, i.e. full scan
+    measure_throughput("find char (loop over cc::string_view)", bytes, [&] {
+        size_t pos = 0;
+        for (auto c : sv)
+        {
+            if (c == '#')
+                break;
+            ++pos;
+        }
+        ct::sink << pos;
+    });
+    measure_throughput("find char (memchr)", bytes, [&] { ct::sink << (std::memchr(text.data(), '#', bytes) != nullptr); });
+
+    // find_any_of, e.g. the first comment or quote
+    measure_throughput("find_any_of (loop over cc::string_view)", bytes, [&] {
+        size_t pos = 0;
+        for (auto c : sv)
+        {
+            if (c == '#' || c == '"' || c == '/')
+                break;
+            ++pos;
+        }
+        ct::sink << pos;
+    });
+    measure_throughput("find_any_of (std::string_view::find_first_of)", bytes, [&] { ct::sink << ssv.find_first_of("#\"/"); });
+
+    // substring that does not occur
+    measure_throughput("find substring (loop over cc::string_view)", bytes, [&] {
+        auto const needle = cc::string_view("usemtl glass");
+        auto const* d = sv.data();
+        auto pos = sv.size();
+        for (size_t i = 0; i + needle.size() <= sv.size(); ++i)
+            if (d[i] == needle.data()[0] && cc::string_view(d + i, needle.size()) == needle)
+            {
+                pos = i;
+                break;
+            }
+        ct::sink << pos;
+    });
+    measure_throughput("find substring (std::string_view::find)", bytes, [&] { ct::sink << ssv.find("usemtl glass"); });
+    measure_throughput("find substring (std::search)", bytes, [&] {
+        char const needle[] = "usemtl glass";
+        ct::sink << (std::search(sv.begin(), sv.end(), needle, needle + sizeof(needle) - 1) != sv.end());
+    });
+
+    // line iteration
+    measure_throughput("lines (cc::string_view::split('\\n'))", bytes, [&] {
+        size_t len = 0;
+        for (auto line : sv.split('\n'))
+            len += line.size();
+        ct::sink << len;
+    });
+    measure_throughput("lines (memchr)", bytes, [&] {
+        size_t len = 0;
+        auto p = text.data();
+        auto const end = text.data() + text.size();
+        while (p < end)
+        {
+            auto nl = static_cast<char const*>(std::memchr(p, '\n', size_t(end - p)));
+            if (!nl)
+                nl = end;
+            len += size_t(nl - p);
+            p = nl + 1;
+        }
+        ct::sink << len;
+    });
+
+    // whitespace tokenization
+    measure_throughput("words (cc::string_view::split())", bytes, [&] {
+        size_t cnt = 0;
+        for (auto word : sv.split())
+            cnt += !word.empty();
+        ct::sink << cnt;
+    });
+}
@@ -0,0 +1,82 @@
+#include <nexus/test.hh>
+
+#include <cstdio>
+
+#include <clean-core/format.hh>
+#include <clean-core/to_string.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+TEST("cc::to_string number benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    constexpr int count = 10'000'000;
+
+    tg::rng rng;
+    auto floats = cc::vector<float>::defaulted(count);
+    auto doubles = cc::vector<double>::defaulted(count);
+    auto ints = cc::vector<int>::defaulted(count);
+    for (auto i = 0; i < count; ++i)
+    {
+        floats[i] = uniform(rng, -1000.f, 1000.f);
+        doubles[i] = uniform(rng, -1e6, 1e6);
+        ints[i] = uniform(rng, -1'000'000'000, 1'000'000'000);
+    }
+
+    measure("cc::to_string(int)", count, [&] {
+        size_t len = 0;
+        for (auto v : ints)
+            len += cc::to_string(v).size();
+        ct::sink << len;
+    });
+    measure("cc::to_string(float)", count, [&] {
+        size_t len = 0;
+        for (auto v : floats)
+            len += cc::to_string(v).size();
+        ct::sink << len;
+    });
+    measure("cc::to_string(double)", count, [&] {
+        size_t len = 0;
+        for (auto v : doubles)
+            len += cc::to_string(v).size();
+        ct::sink << len;
+    });
+    measure("cc::format(\"{}\", float)", count, [&] {
+        size_t len = 0;
+        for (auto v : floats)
+            len += cc::format("{}", v).size();
+        ct::sink << len;
+    });
+
+    // printf-style reference, %.9g / %.17g are enough digits to round-trip but not shortest
+    measure("snprintf %d", count, [&] {
+        char buffer[32];
+        size_t len = 0;
+        for (auto v : ints)
+            len += std::snprintf(buffer, sizeof(buffer), "%d", v);
+        ct::sink << len;
+    });
+    measure("snprintf %.9g (float)", count, [&] {
+        char buffer[32];
+        size_t len = 0;
+        for (auto v : floats)
+            len += std::snprintf(buffer, sizeof(buffer), "%.9g", double(v));
+        ct::sink << len;
+    });
+    measure("snprintf %.17g (double)", count, [&] {
+        char buffer[32];
+        size_t len = 0;
+        for (auto v : doubles)
+            len += std::snprintf(buffer, sizeof(buffer), "%.17g", v);
+        ct::sink << len;
+    });
+}
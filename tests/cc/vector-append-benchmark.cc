@@ -0,0 +1,94 @@
+#include <nexus/test.hh>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <clean-core/alloc_vector.hh>
+#include <clean-core/vector.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// NOTE: 1e9 ints need 4 GB (8 GB peak during growth), so the default is lower
+constexpr size_t append_count = 100'000'000;
+
+// realloc can grow large blocks in place or move them via mremap without copying,
+// so the bytes copied and the old + new peak can only be derived for vectors that allocate and copy
+template <class vector_t>
+constexpr bool grows_via_realloc = false;
+template <class T>
+constexpr bool grows_via_realloc<cc::alloc_vector<T>> = true;
+
+// appends count elements twice into a fresh vector:
+// a clean pass that is timed, and an instrumented pass that reports how often the storage moved,
+// and (for allocate + copy growth) how many bytes were copied by that and the peak footprint during a growth step
+template <class vector_t>
+void bench_append(std::string const& name, size_t count, bool reserve = false)
+{
+    using T = std::decay_t<decltype(std::declval<vector_t&>()[0])>;
+
+    uint64_t cycles = 0;
+    {
+        vector_t v;
+        if (reserve)
+            v.reserve(count);
+
+        auto const c = ct::current_cycles();
+        for (size_t i = 0; i < count; ++i)
+            v.push_back(T(i));
+        cycles = ct::current_cycles() - c;
+        ct::sink << v.size();
+    }
+
+    size_t relocations = 0;
+    size_t copied_bytes = 0;
+    size_t peak_bytes = 0;
+
+    vector_t v;
+    if (reserve)
+        v.reserve(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto const old_data = v.data();
+        auto const old_cap = v.capacity();
+
+        v.push_back(T(i));
+
+        if (v.data() != old_data && old_data != nullptr)
+        {
+            ++relocations;
+            copied_bytes += (v.size() - 1) * sizeof(T);
+            peak_bytes = std::max(peak_bytes, (old_cap + v.capacity()) * sizeof(T));
+        }
+    }
+
+    std::cout << name << ": " << cycles / count << " cycles / element, " << relocations << " relocations, ";
+    if constexpr (grows_via_realloc<vector_t>)
+        std::cout << (v.capacity() * sizeof(T) >> 20) << " MB final footprint (copies and growth peak not observable through realloc)";
+    else
+        std::cout << (copied_bytes >> 20) << " MB copied, " << (std::max(peak_bytes, v.capacity() * sizeof(T)) >> 20) << " MB peak";
+    std::cout << std::endl;
+}
+}
+
+TEST("vector append benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    bench_append<std::vector<int>>("std::vector<int>", append_count);
+    bench_append<cc::vector<int>>("cc::vector<int>", append_count);
+
+    // realloc-based growth
+    bench_append<cc::alloc_vector<int>>("cc::alloc_vector<int>", append_count);
+
+    // never relocates, but needs the final size up front
+    bench_append<cc::vector<int>>("cc::vector<int> (reserved)", append_count, true);
+}
@@ -0,0 +1,101 @@
+#include <nexus/test.hh>
+
+#include <vector>
+
+#include <clean-core/alloc_vector.hh>
+#include <clean-core/capped_vector.hh>
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "benchmark_util.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+// models per-entity lists: most hold 0..8 elements, a long tail needs more
+cc::vector<int> make_list_sizes(tg::rng& rng, int count)
+{
+    cc::vector<int> sizes;
+    for (auto i = 0; i < count; ++i)
+        sizes.push_back(uniform(rng, 0, 99) < 95 ? uniform(rng, 0, 8) : uniform(rng, 9, 64));
+    return sizes;
+}
+
+template <class list_t, class F>
+void bench_lists(std::string const& name, cc::vector<int> const& sizes, F&& make_list)
+{
+    measure(name, sizes.size(), [&] {
+        cc::vector<list_t> lists;
+        lists.reserve(sizes.size());
+
+        for (auto s : sizes)
+        {
+            auto& l = lists.emplace_back(make_list());
+            for (auto i = 0; i < s; ++i)
+                l.push_back(i);
+        }
+
+        auto sum = 0;
+        for (auto const& l : lists)
+            for (auto i : l)
+                sum += i;
+        ct::sink << sum;
+    });
+}
+}
+
+TEST("cc::vector small lists benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+    auto const sizes = make_list_sizes(rng, 100'000);
+
+    auto inline_cnt = 0;
+    for (auto s : sizes)
+        if (s <= 8)
+            ++inline_cnt;
+    std::cout << inline_cnt << " / " << sizes.size() << " lists have at most 8 elements" << std::endl;
+
+    // always heap, one allocation per non-empty list (plus growth)
+    bench_lists<std::vector<int>>("std::vector<int>", sizes, [] { return std::vector<int>(); });
+    bench_lists<cc::vector<int>>("cc::vector<int>", sizes, [] { return cc::vector<int>(); });
+
+    // one allocation per list, but no growth for the common case
+    bench_lists<cc::vector<int>>("cc::vector<int> (reserve 8)", sizes, [] {
+        cc::vector<int> v;
+        v.reserve(8);
+        return v;
+    });
+
+    // never allocates, upper bound for inline storage (but 64 ints per entity)
+    bench_lists<cc::capped_vector<int, 64>>("cc::capped_vector<int, 64>", sizes, [] { return cc::capped_vector<int, 64>(); });
+
+    // heap part from a linear allocator
+    {
+        auto buffer = cc::vector<std::byte>::defaulted(64 << 20);
+        measure("cc::alloc_vector<int> (linear_allocator)", sizes.size(), [&] {
+            cc::linear_allocator linalloc(buffer);
+            cc::vector<cc::alloc_vector<int>> lists;
+            lists.reserve(sizes.size());
+
+            for (auto s : sizes)
+            {
+                auto& l = lists.emplace_back(&linalloc);
+                for (auto i = 0; i < s; ++i)
+                    l.push_back(i);
+            }
+
+            auto sum = 0;
+            for (auto const& l : lists)
+                for (auto i : l)
+                    sum += i;
+            ct::sink << sum;
+        });
+    }
+}
@@ -0,0 +1,130 @@
+#include <nexus/test.hh>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include <clean-core/span.hh>
+#include <clean-core/vector.hh>
+
+#include <clean-ranges/algorithms.hh>
+#include <clean-ranges/algorithms/minmax.hh>
+
+#include <typed-geometry/feature/random.hh>
+
+#include "../measure_ms.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+constexpr int element_count = 100'000'000;
+
+int64_t gSink = 0;
+float gSinkF = 0;
+
+template <class T>
+void sink(T v)
+{
+    if constexpr (std::is_floating_point_v<T>)
+        gSinkF += v;
+    else
+        gSink += v;
+}
+
+// min / max / minmax / count / contains, through cr on a cc::vector and a cc::span and as hand-written loops
+// absent is never in values, so contains always scans everything
+template <class T>
+void bench_search(std::string const& type, cc::vector<T> const& values, T present, T absent)
+{
+    auto const bench_cr = [&](std::string const& range_name, auto const& range) {
+        measure_ms("cr::min(" + range_name + ")", [&] { sink(cr::min(range)); });
+        measure_ms("cr::max(" + range_name + ")", [&] { sink(cr::max(range)); });
+        measure_ms("cr::minmax(" + range_name + ")", [&] {
+            auto const mm = cr::minmax(range);
+            sink(mm.min + mm.max);
+        });
+        measure_ms("cr::count(" + range_name + ", present)", [&] { sink(cr::count(range, present)); });
+        measure_ms("cr::contains(" + range_name + ", absent)", [&] { sink(cr::contains(range, absent)); });
+    };
+    bench_cr("cc::vector<" + type + ">", values);
+    bench_cr("cc::span<" + type + " const>", cc::span<T const>(values));
+
+    auto const n = int(values.size());
+    measure_ms("minmax<" + type + "> (loop)", [&] {
+        auto vmin = values[0];
+        auto vmax = values[0];
+        for (auto i = 1; i < n; ++i)
+        {
+            vmin = values[i] < vmin ? values[i] : vmin;
+            vmax = vmax < values[i] ? values[i] : vmax;
+        }
+        sink(vmin + vmax);
+    });
+    measure_ms("count<" + type + "> (loop)", [&] {
+        auto cnt = 0;
+        for (auto i = 0; i < n; ++i)
+            cnt += values[i] == present;
+        sink(cnt);
+    });
+    measure_ms("contains<" + type + "> (loop)", [&] {
+        auto found = false;
+        for (auto i = 0; i < n && !found; ++i)
+            found = values[i] == absent;
+        sink(int(found));
+    });
+}
+}
+
+TEST("cr algorithms on contiguous arithmetic ranges benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    tg::rng rng;
+
+    // small ints so that cr::sum(ints) does not overflow
+    auto ints = cc::vector<int>::defaulted(element_count);
+    auto floats = cc::vector<float>::defaulted(element_count);
+    for (auto i = 0; i < element_count; ++i)
+    {
+        ints[i] = uniform(rng, 0, 9);
+        floats[i] = uniform(rng, 0.f, 1.f);
+    }
+    auto const int_span = cc::span<int const>(ints);
+    auto const float_span = cc::span<float const>(floats);
+
+    // sum
+    measure_ms("cr::sum(cc::vector<int>)", [&] { gSink += cr::sum(ints); });
+    measure_ms("cr::sum(cc::span<int const>)", [&] { gSink += cr::sum(int_span); });
+    measure_ms("sum<int> (loop)", [&] {
+        auto s = 0;
+        for (auto i = 0; i < element_count; ++i)
+            s += ints[i];
+        gSink += s;
+    });
+    measure_ms("cr::sum(cc::vector<float>)", [&] { gSinkF += cr::sum(floats); });
+    measure_ms("cr::sum(cc::span<float const>)", [&] { gSinkF += cr::sum(float_span); });
+    // strict left-to-right order, the compiler may not vectorize this without -ffast-math
+    measure_ms("sum<float> (loop)", [&] {
+        auto s = 0.f;
+        for (auto i = 0; i < element_count; ++i)
+            s += floats[i];
+        gSinkF += s;
+    });
+    // reassociated: 8 independent accumulators, different rounding than the sequential order
+    measure_ms("sum<float> (loop, 8 accumulators)", [&] {
+        float s[8] = {};
+        for (auto i = 0; i < element_count; i += 8)
+            for (auto j = 0; j < 8; ++j)
+                s[j] += floats[i + j];
+        gSinkF += ((s[0] + s[1]) + (s[2] + s[3])) + ((s[4] + s[5]) + (s[6] + s[7]));
+    });
+
+    // min / max / minmax / count / contains
+    bench_search<int>("int", ints, 3, 10);
+    // floats are in [0, 1), so 2 never occurs, and an existing value is counted
+    bench_search<float>("float", floats, floats[element_count / 2], 2.f);
+}
@@ -0,0 +1,112 @@
+#include <nexus/test.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <clean-core/span.hh>
+#include <clean-core/vector.hh>
+
+#include <clean-ranges/algorithms.hh>
+
+#include <task-dispatcher/td.hh>
+
+#include "../measure_ms.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+constexpr int element_count = 100'000'000;
+
+int64_t gSink = 0;
+
+// sequential cr algorithm per chunk, chunks distributed via td::submit_batched
+void bench_parallel(int num_threads, cc::vector<int> const& values, cc::vector<int>& out, cc::vector<int64_t>& chunk_sums)
+{
+    auto const prefix = "[" + std::to_string(num_threads) + " threads] ";
+    auto const data = values.data();
+
+    td::scheduler_config config;
+    config.num_threads = num_threads;
+    td::launch(config, [&] {
+        measure_ms(prefix + "cr::sum in td::submit_batched chunks", [&] {
+            std::atomic<int64_t> sum = 0;
+            auto s = td::submit_batched(
+                [&](auto begin, auto end) { sum += cr::sum<int64_t>(cc::span<int const>(data + begin, size_t(end - begin))); }, element_count);
+            td::wait_for(s);
+            gSink += sum.load();
+        });
+
+        measure_ms(prefix + "transform in td::submit_batched chunks", [&] {
+            auto s = td::submit_batched(
+                [&](auto begin, auto end) {
+                    for (auto i = begin; i < end; ++i)
+                        out[i] = values[i] * 3 + 1;
+                },
+                element_count);
+            td::wait_for(s);
+        });
+
+        // two passes: per-chunk sums, then each chunk rescans with its offset
+        measure_ms(prefix + "inclusive scan in td::submit_n chunks", [&] {
+            auto const num_chunks = int(chunk_sums.size());
+            auto const chunk_size = (element_count + num_chunks - 1) / num_chunks;
+            auto const chunk_begin = [&](int c) { return std::min(c * chunk_size, element_count); };
+            auto const chunk = [&](int c) { return cc::span<int const>(data + chunk_begin(c), size_t(chunk_begin(c + 1) - chunk_begin(c))); };
+
+            auto s1 = td::submit_n([&](auto c) { chunk_sums[c] = cr::sum<int64_t>(chunk(c)); }, num_chunks);
+            td::wait_for(s1);
+
+            for (auto c = 1; c < num_chunks; ++c)
+                chunk_sums[c] += chunk_sums[c - 1];
+
+            auto s2 = td::submit_n(
+                [&](auto c) {
+                    // NOTE: int is enough for the benchmark values, the real scan would use the accumulator type
+                    auto acc = c == 0 ? 0 : int(chunk_sums[c - 1]);
+                    for (auto i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+                        out[i] = acc += values[i];
+                },
+                num_chunks);
+            td::wait_for(s2);
+        });
+    });
+}
+}
+
+TEST("cr::par benchmark", exclusive)
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    // small values so that the int scan does not overflow
+    auto values = cc::vector<int>::defaulted(element_count);
+    for (auto i = 0; i < element_count; ++i)
+        values[i] = i % 7 == 0 ? 1 : 0;
+    auto out = cc::vector<int>::defaulted(element_count);
+
+    // sequential baseline
+    measure_ms("cr::sum", [&] { gSink += cr::sum<int64_t>(values); });
+    measure_ms("transform (loop)", [&] {
+        for (auto i = 0; i < element_count; ++i)
+            out[i] = values[i] * 3 + 1;
+    });
+    measure_ms("inclusive scan (loop)", [&] {
+        auto acc = 0;
+        for (auto i = 0; i < element_count; ++i)
+            out[i] = acc += values[i];
+    });
+
+    auto const max_threads = int(std::thread::hardware_concurrency());
+    for (auto num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        // a few chunks per thread to even out imbalance
+        auto chunk_sums = cc::vector<int64_t>::defaulted(num_threads * 4);
+        bench_parallel(num_threads, values, out, chunk_sums);
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+// best of 3 wall-clock runs in ms
+// for test targets that do not link ctracer (see tests/cc/benchmark_util.hh for the cycle-based helpers)
+template <class F>
+void measure_ms(std::string const& name, F&& f)
+{
+    double best_ms = 0;
+    for (auto r = 0; r < 3; ++r)
+    {
+        auto const start = std::chrono::high_resolution_clock::now();
+        f();
+        auto const end = std::chrono::high_resolution_clock::now();
+        auto const ms = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+        if (r == 0 || ms < best_ms)
+            best_ms = ms;
+    }
+    std::cout << name << ": " << best_ms << " ms" << std::endl;
+}
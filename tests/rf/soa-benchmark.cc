@@ -0,0 +1,110 @@
+#include <nexus/test.hh>
+
+#include <clean-core/vector.hh>
+
+#include <typed-geometry/feature/random.hh>
+#include <typed-geometry/tg.hh>
+
+#include <reflector/introspect.hh>
+#include <reflector/members.hh>
+
+#include "../measure_ms.hh"
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+struct particle
+{
+    tg::pos3 position;
+    tg::vec3 velocity;
+    float mass;
+    int flags;
+};
+
+template <class I>
+constexpr void introspect(I&& i, particle& v)
+{
+    i(v.position, "position");
+    i(v.velocity, "velocity");
+    i(v.mass, "mass");
+    i(v.flags, "flags");
+}
+
+// what a soa_vector<particle> would store, written by hand, one array per scalar for streaming access
+struct particles_soa
+{
+    cc::vector<float> px, py, pz;
+    cc::vector<float> vx, vy, vz;
+    cc::vector<float> mass;
+    cc::vector<int> flags;
+};
+}
+
+TEST("struct of arrays benchmark")
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    // one column per introspected member (the vector members are split into scalars above)
+    static_assert(rf::member_count<particle> == 4);
+
+    constexpr int count = 10'000'000;
+    constexpr float dt = 0.016f;
+
+    tg::rng rng;
+
+    cc::vector<particle> aos;
+    particles_soa soa;
+    for (auto i = 0; i < count; ++i)
+    {
+        particle p;
+        p.position = tg::pos3(uniform(rng, -10.f, 10.f), uniform(rng, -10.f, 10.f), uniform(rng, -10.f, 10.f));
+        p.velocity = tg::vec3(uniform(rng, -1.f, 1.f), uniform(rng, -1.f, 1.f), uniform(rng, -1.f, 1.f));
+        p.mass = uniform(rng, 0.5f, 2.0f);
+        p.flags = 0;
+        aos.push_back(p);
+
+        soa.px.push_back(p.position.x);
+        soa.py.push_back(p.position.y);
+        soa.pz.push_back(p.position.z);
+        soa.vx.push_back(p.velocity.x);
+        soa.vy.push_back(p.velocity.y);
+        soa.vz.push_back(p.velocity.z);
+        soa.mass.push_back(p.mass);
+        soa.flags.push_back(p.flags);
+    }
+
+    // touches 24 of 32 bytes per particle
+    measure_ms("integrate (AoS)", [&] {
+        for (auto& p : aos)
+            p.position += p.velocity * dt;
+    });
+    measure_ms("integrate (SoA)", [&] {
+        for (auto i = 0; i < count; ++i)
+        {
+            soa.px[i] += soa.vx[i] * dt;
+            soa.py[i] += soa.vy[i] * dt;
+            soa.pz[i] += soa.vz[i] * dt;
+        }
+    });
+
+    // touches 4 of 32 bytes per particle
+    auto aos_mass = 0.f;
+    auto soa_mass = 0.f;
+    measure_ms("total mass (AoS)", [&] {
+        auto m = 0.f;
+        for (auto const& p : aos)
+            m += p.mass;
+        aos_mass = m;
+    });
+    measure_ms("total mass (SoA)", [&] {
+        auto m = 0.f;
+        for (auto v : soa.mass)
+            m += v;
+        soa_mass = m;
+    });
+    CHECK(aos_mass == soa_mass);
+}
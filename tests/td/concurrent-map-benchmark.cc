@@ -0,0 +1,155 @@
+#include <nexus/test.hh>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+
+#include <clean-core/map.hh>
+#include <clean-core/vector.hh>
+
+#include <task-dispatcher/td.hh>
+
+#define DO_BENCHMARK 0
+
+namespace
+{
+std::atomic<int64_t> gSink = 0;
+
+// what td tasks currently do to share a cache: one mutex around a cc::map
+struct locked_map
+{
+    template <class F>
+    int get_or_insert(int key, F&& factory)
+    {
+        std::lock_guard lock(_mutex);
+        if (!_map.contains_key(key))
+            _map[key] = factory();
+        return _map.get(key);
+    }
+
+private:
+    std::mutex _mutex;
+    cc::map<int, int> _map;
+};
+
+// readers only contend on the shared lock, inserts re-check under the exclusive lock
+struct shared_locked_map
+{
+    template <class F>
+    int get_or_insert(int key, F&& factory)
+    {
+        {
+            std::shared_lock lock(_mutex);
+            if (_map.contains_key(key))
+                return _map.get(key);
+        }
+
+        std::unique_lock lock(_mutex);
+        if (!_map.contains_key(key))
+            _map[key] = factory();
+        return _map.get(key);
+    }
+
+private:
+    std::shared_mutex _mutex;
+    cc::map<int, int> _map;
+};
+
+// reference point for lock striping: independent locked maps, each starting on its own cache line
+struct striped_map
+{
+    template <class F>
+    int get_or_insert(int key, F&& factory)
+    {
+        auto const shard = size_t(uint64_t(key) * 0x9E3779B97F4A7C15ull >> 58);
+        return _shards[shard].map.get_or_insert(key, factory);
+    }
+
+private:
+    struct alignas(64) shard
+    {
+        locked_map map;
+    };
+    std::array<shard, 64> _shards;
+};
+
+constexpr int key_range = 1 << 20;
+constexpr int op_count = 10'000'000;
+
+// best of 3, every run starts from a freshly prefilled map so that the 5% inserts are first-time inserts again
+template <class map_t>
+void bench_map(char const* name, int num_threads, cc::vector<int> const& keys)
+{
+    td::scheduler_config config;
+    config.num_threads = num_threads;
+
+    double best_ms = 0;
+    td::launch(config, [&] {
+        for (auto r = 0; r < 3; ++r)
+        {
+            // maps hold mutexes and are not movable, so each run gets a new one
+            auto const map = std::make_unique<map_t>();
+            for (auto k = 0; k < key_range; ++k)
+                map->get_or_insert(k, [k] { return k; });
+
+            auto const start = std::chrono::high_resolution_clock::now();
+
+            td::sync s;
+            td::submit_batched(
+                s,
+                [&](auto begin, auto end) {
+                    int64_t sum = 0;
+                    for (auto i = begin; i < end; ++i)
+                    {
+                        auto const k = keys[i];
+                        sum += map->get_or_insert(k, [k] { return k; });
+                    }
+                    gSink += sum;
+                },
+                op_count);
+            td::wait_for(s);
+
+            auto const end = std::chrono::high_resolution_clock::now();
+            auto const ms = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+            if (r == 0 || ms < best_ms)
+                best_ms = ms;
+        }
+    });
+
+    std::cout << name << " [" << num_threads << " threads]: " << best_ms << " ms, " << op_count / best_ms / 1000.0 << " Mops / s" << std::endl;
+}
+}
+
+TEST("td concurrent map benchmark", exclusive)
+{
+#if !DO_BENCHMARK
+    CHECK(true);
+    return;
+#endif
+
+    // read-mostly: 95% hits on the prefilled keys, 5% first-time inserts
+    std::mt19937 rng;
+    cc::vector<int> keys;
+    for (auto i = 0; i < op_count; ++i)
+    {
+        if (std::uniform_int_distribution<int>(0, 19)(rng) == 0)
+            keys.push_back(key_range + std::uniform_int_distribution<int>(0, key_range - 1)(rng));
+        else
+            keys.push_back(std::uniform_int_distribution<int>(0, key_range - 1)(rng));
+    }
+
+    auto const max_threads = int(std::thread::hardware_concurrency());
+    for (auto num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        bench_map<locked_map>("mutex + cc::map", num_threads, keys);
+        bench_map<shared_locked_map>("shared_mutex + cc::map", num_threads, keys);
+        bench_map<striped_map>("64 x (mutex + cc::map)", num_threads, keys);
+    }
+}